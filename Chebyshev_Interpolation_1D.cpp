@@ -75,6 +75,35 @@ void Chebyshev_polynomials(unsigned rank, double* x, unsigned n, double*& T){
 	}
 }
 
+/********************************************************************************/
+//      FUNCTION:               Chebyshev_polynomials_and_derivatives           //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Evaluates the first rank Chebyshev polynomials  //
+//                              and their derivatives at the locations x in     //
+//                              [-1,1]. The derivatives are obtained as         //
+//                              T'_k = k*U_{k-1}, where U_k are the Chebyshev   //
+//                              polynomials of the second kind.                 //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      rank    -       Number of terms in the approximation.                   //
+//      x       -       Location of points in the interval [-1,1].              //
+//      n       -       Number of points.                                       //
+//      T       -       Matrix with 'n' rows and 'rank' columns, where          //
+//                      T(rank*i+j) stores the 'j'th Chebyshev polynomial       //
+//                      evaluated at the 'i'th location.                        //
+//      dT      -       Matrix with 'n' rows and 'rank' columns, where          //
+//                      dT(rank*i+j) stores the derivative of the 'j'th         //
+//                      Chebyshev polynomial evaluated at the 'i'th location.   //
+//                                                                              //
+/********************************************************************************/
+void Chebyshev_polynomials_and_derivatives(unsigned rank, double* x, unsigned n, double*& T, double*& dT){
+        T       =       new double [n*rank];
+        dT      =       new double [n*rank];
+        for (unsigned k=0; k<n; ++k) {
+                Chebyshev_polynomials_and_derivatives_at_point(rank, x[k], T+k*rank, dT+k*rank);
+        }
+}
+
 /********************************************************************************/
 //      FUNCTION:               get_standard_Chebyshev_nodes                    //
 //                                                                              //
@@ -111,6 +140,93 @@ void get_standard_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes(unsigned ra
 	Chebyshev_polynomials(rank, standardchebnodes, rank, T);
 }
 
+/********************************************************************************************************/
+//      FUNCTION:               get_weighted_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes         //
+//                                                                                                      //
+//      PURPOSE OF EXISTENCE:   Evaluates the first rank Chebyshev polynomials at the Chebyshev nodes   //
+//                              with the weights of the interpolation formula folded in, so that the    //
+//                              L2L operator is L2L(i,j) = sum_k T_k(x_i)*T(rank*j+k).                  //
+//                                                                                                      //
+//      PARAMETERS:                                                                                     //
+//      rank                    -       The number of polynomials and the number of Chebyshev nodes.    //
+//      x_Cheb_Nodes            -       Standard Cheb Nodes in interval [-1,1].                         //
+//      T                       -       Matrix, where T(rank*j+k) stores (1 or 2)/rank times the 'k'th  //
+//                                      Chebyshev polynomial evaluated at the 'j'th node.               //
+//                                                                                                      //
+/********************************************************************************************************/
+void get_weighted_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes(unsigned rank, double* x_Cheb_Nodes, double*& T) {
+        Chebyshev_polynomials(rank, x_Cheb_Nodes, rank, T);
+        double scale    =       1.0/rank;
+        for (unsigned j=0; j<rank; ++j) {
+                for (unsigned k=0; k<rank; ++k) {
+                        T[j*rank+k]     =       (k==0 ? 1.0 : 2.0)*scale*T[j*rank+k];
+                }
+        }
+}
+
+/********************************************************************************/
+//      FUNCTION:               Chebyshev_polynomials_at_point                  //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Evaluates the first rank Chebyshev polynomials  //
+//                              at one location x in [-1,1] into a buffer.      //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      rank    -       Number of terms in the approximation.                   //
+//      x       -       Location of the point in the interval [-1,1].           //
+//      T       -       Buffer with 'rank' entries, where T[j] stores the 'j'th //
+//                      Chebyshev polynomial evaluated at x.                    //
+//                                                                              //
+/********************************************************************************/
+void Chebyshev_polynomials_at_point(unsigned rank, double x, double* T) {
+        if (rank>=1) {
+                T[0]    =       1.0;
+        }
+        if (rank>=2) {
+                T[1]    =       x;
+        }
+        for (unsigned k=2; k<rank; ++k) {
+                T[k]    =       2*x*T[k-1]-T[k-2];
+        }
+}
+
+/********************************************************************************/
+//      FUNCTION:               Chebyshev_polynomials_and_derivatives_at_point  //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Evaluates the first rank Chebyshev polynomials  //
+//                              and their derivatives T'_k = k*U_{k-1} at one   //
+//                              location x in [-1,1] into buffers.              //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      rank    -       Number of terms in the approximation.                   //
+//      x       -       Location of the point in the interval [-1,1].           //
+//      T       -       Buffer with 'rank' entries, where T[j] stores the 'j'th //
+//                      Chebyshev polynomial evaluated at x.                    //
+//      dT      -       Buffer with 'rank' entries, where dT[j] stores the      //
+//                      derivative of the 'j'th Chebyshev polynomial at x.      //
+//                                                                              //
+/********************************************************************************/
+void Chebyshev_polynomials_and_derivatives_at_point(unsigned rank, double x, double* T, double* dT) {
+        if (rank>=1) {
+                T[0]    =       1.0;
+                dT[0]   =       0.0;
+        }
+        if (rank>=2) {
+                T[1]    =       x;
+                dT[1]   =       1.0;
+        }
+        //      U_0 = 1 and U_1 = 2x.
+        double U_Previous       =       1.0;
+        double U_Current        =       2.0*x;
+        double U_Next;
+        for (unsigned k=2; k<rank; ++k) {
+                T[k]            =       2*x*T[k-1]-T[k-2];
+                dT[k]           =       k*U_Current;
+                U_Next          =       2*x*U_Current-U_Previous;
+                U_Previous      =       U_Current;
+                U_Current       =       U_Next;
+        }
+}
+
 /********************************************************************************/
 //      FUNCTION:               get_Chebyshev_L2L_Operator                      //
 //                                                                              //
@@ -151,6 +267,289 @@ void get_Chebyshev_L2L_Operator(double* x, unsigned n, double* x_Cheb_Nodes, uns
 }
 
 
+/********************************************************************************/
+//      FUNCTION:               get_Chebyshev_L2L_Operator_with_Derivative      //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Obtains the interpolation or L2L operator and   //
+//                              its derivative with respect to x, which         //
+//                              transfer information from the Chebyshev nodes   //
+//                              to the value and derivative at the points x.    //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      x                       -       Locations of points in interval [-1,1]. //
+//      n                       -       Number of points in the interval.       //
+//      x_Cheb_Nodes            -       Standard Cheb Nodes in interval [-1,1]. //
+//      rank                    -       Number of Chebyshev nodes.              //
+//      L2L                     -       Interpolation or L2L operator.          //
+//      dL2L                    -       Derivative of the L2L operator with     //
+//                                      respect to the standard location x.     //
+//                                      Divide by the radius of the cluster to  //
+//                                      obtain the derivative in the original   //
+//                                      coordinates.                            //
+//                                                                              //
+/********************************************************************************/
+void get_Chebyshev_L2L_Operator_with_Derivative(double* x, unsigned n, double* x_Cheb_Nodes, unsigned rank, double*& L2L, double*& dL2L) {
+        double* Tx;
+        double* dTx;
+        double* Tcheb;
+
+        Chebyshev_polynomials_and_derivatives(rank, x, n, Tx, dTx);
+        Chebyshev_polynomials(rank, x_Cheb_Nodes, rank, Tcheb);
+
+        unsigned index1, index2;
+
+        L2L             =       new double[n*rank];
+        dL2L            =       new double[n*rank];
+        double scale    =       1.0/rank;
+        for (unsigned i=0; i<n; ++i) {
+                index1  =       i*rank;
+                for (unsigned j=0; j<rank; ++j) {
+                        L2L[index1+j]   =       -1.0;
+                        dL2L[index1+j]  =       0.0;
+                        index2          =       j*rank;
+                        for (unsigned k=0; k<rank; ++k) {
+                                L2L[index1+j]   =       L2L[index1+j]+2.0*Tx[index1+k]*Tcheb[index2+k];
+                                dL2L[index1+j]  =       dL2L[index1+j]+2.0*dTx[index1+k]*Tcheb[index2+k];
+                        }
+                        L2L[index1+j]   =       scale*L2L[index1+j];
+                        dL2L[index1+j]  =       scale*dL2L[index1+j];
+                }
+        }
+
+        delete [] Tx;
+        delete [] dTx;
+        delete [] Tcheb;
+}
+
+/********************************************************************************/
+//      FUNCTION:               apply_Chebyshev_L2L_with_Derivative             //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Interpolates the values 'q' at the Chebyshev    //
+//                              nodes to the points x and obtains the value and //
+//                              the derivative in one sweep over the points,    //
+//                              without forming the 'n' by 'rank' L2L operator. //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      x                       -       Locations of points in interval [-1,1]. //
+//      n                       -       Number of points in the interval.       //
+//      x_Cheb_Nodes            -       Standard Cheb Nodes in interval [-1,1]. //
+//      rank                    -       Number of Chebyshev nodes.              //
+//      radius                  -       Radius of the cluster, used to scale the//
+//                                      derivative to the original coordinates. //
+//      q                       -       Values at the 'rank' Chebyshev nodes.   //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      potential               -       Interpolated values at the points x.    //
+//      derivative              -       Interpolated derivative at the points x.//
+//                                                                              //
+/********************************************************************************/
+void apply_Chebyshev_L2L_with_Derivative(double* x, unsigned n, double* x_Cheb_Nodes, unsigned rank, double radius, double* q, double*& potential, double*& derivative) {
+        double* Tcheb;
+        get_weighted_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes(rank, x_Cheb_Nodes, Tcheb);
+
+        //      Chebyshev coefficients of the interpolant, i.e., the interpolant
+        //      is sum_k c[k]*T_k(x). Only these 'rank' numbers are needed per point.
+        double* c       =       new double[rank];
+        for (unsigned k=0; k<rank; ++k) {
+                c[k]    =       0.0;
+                for (unsigned j=0; j<rank; ++j) {
+                        c[k]    =       c[k]+Tcheb[j*rank+k]*q[j];
+                }
+        }
+
+        potential       =       new double[n];
+        derivative      =       new double[n];
+        double* T       =       new double[rank];
+        double* dT      =       new double[rank];
+        for (unsigned i=0; i<n; ++i) {
+                Chebyshev_polynomials_and_derivatives_at_point(rank, x[i], T, dT);
+                potential[i]    =       0.0;
+                derivative[i]   =       0.0;
+                for (unsigned k=0; k<rank; ++k) {
+                        potential[i]    =       potential[i]+c[k]*T[k];
+                        derivative[i]   =       derivative[i]+c[k]*dT[k];
+                }
+                derivative[i]   =       derivative[i]/radius;
+        }
+
+        delete [] T;
+        delete [] dT;
+        delete [] c;
+        delete [] Tcheb;
+}
+
+
+/********************************************************************************/
+//      FUNCTION:               get_Scaled_Chebyshev_L2L_Operator               //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Obtains the interpolation or L2L operator for   //
+//                              points x in the interval center +/- radius.     //
+//                              The points are scaled and the Chebyshev         //
+//                              polynomials evaluated one point at a time, so   //
+//                              no scaled copy of x and no 'n' by 'rank' table  //
+//                              of polynomials are formed.                      //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      x                       -       Locations of points in the interval.    //
+//      n                       -       Number of points in the interval.       //
+//      center                  -       Center of the interval.                 //
+//      radius                  -       Radius of the interval.                 //
+//      x_Cheb_Nodes            -       Standard Cheb Nodes in interval [-1,1]. //
+//      rank                    -       Number of Chebyshev nodes.              //
+//      L2L                     -       Interpolation or L2L operator.          //
+//                                                                              //
+/********************************************************************************/
+void get_Scaled_Chebyshev_L2L_Operator(double* x, unsigned n, double center, double radius, double* x_Cheb_Nodes, unsigned rank, double*& L2L) {
+        double* Tcheb;
+        get_weighted_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes(rank, x_Cheb_Nodes, Tcheb);
+
+        L2L             =       new double[n*rank];
+        double* T       =       new double[rank];
+        unsigned index;
+        for (unsigned i=0; i<n; ++i) {
+                Chebyshev_polynomials_at_point(rank, (x[i]-center)/radius, T);
+
+                index   =       i*rank;
+                for (unsigned j=0; j<rank; ++j) {
+                        L2L[index+j]    =       0.0;
+                        for (unsigned k=0; k<rank; ++k) {
+                                L2L[index+j]    =       L2L[index+j]+T[k]*Tcheb[j*rank+k];
+                        }
+                }
+        }
+
+        delete [] T;
+        delete [] Tcheb;
+}
+
+/********************************************************************************/
+//      FUNCTION:               apply_Scaled_Chebyshev_L2L                      //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Computes L2L*q for points x in the interval     //
+//                              center +/- radius without forming L2L, a scaled //
+//                              copy of x or a table of Chebyshev polynomials.  //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      x                       -       Locations of points in the interval.    //
+//      n                       -       Number of points in the interval.       //
+//      center                  -       Center of the interval.                 //
+//      radius                  -       Radius of the interval.                 //
+//      x_Cheb_Nodes            -       Standard Cheb Nodes in interval [-1,1]. //
+//      rank                    -       Number of Chebyshev nodes.              //
+//      q                       -       Matrix with 'rank' rows and 'n_RHS'     //
+//                                      columns of values at the nodes.         //
+//      n_RHS                   -       Number of columns of q.                 //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      potential               -       Matrix with 'n' rows and 'n_RHS'        //
+//                                      columns of values at the points x.      //
+//                                                                              //
+/********************************************************************************/
+void apply_Scaled_Chebyshev_L2L(double* x, unsigned n, double center, double radius, double* x_Cheb_Nodes, unsigned rank, double* q, unsigned n_RHS, double*& potential) {
+        double* Tcheb;
+        get_weighted_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes(rank, x_Cheb_Nodes, Tcheb);
+
+        //      Chebyshev coefficients of the interpolant of every column of q.
+        double* C       =       new double[rank*n_RHS];
+        for (unsigned k=0; k<rank; ++k) {
+                for (unsigned l=0; l<n_RHS; ++l) {
+                        C[k*n_RHS+l]    =       0.0;
+                        for (unsigned j=0; j<rank; ++j) {
+                                C[k*n_RHS+l]    =       C[k*n_RHS+l]+Tcheb[j*rank+k]*q[j*n_RHS+l];
+                        }
+                }
+        }
+
+        potential       =       new double[n*n_RHS];
+        double* T       =       new double[rank];
+        unsigned index;
+        for (unsigned i=0; i<n; ++i) {
+                Chebyshev_polynomials_at_point(rank, (x[i]-center)/radius, T);
+
+                index   =       i*n_RHS;
+                for (unsigned l=0; l<n_RHS; ++l) {
+                        potential[index+l]      =       0.0;
+                }
+                for (unsigned k=0; k<rank; ++k) {
+                        for (unsigned l=0; l<n_RHS; ++l) {
+                                potential[index+l]      =       potential[index+l]+T[k]*C[k*n_RHS+l];
+                        }
+                }
+        }
+
+        delete [] T;
+        delete [] C;
+        delete [] Tcheb;
+}
+
+/********************************************************************************/
+//      FUNCTION:               anterpolate_Scaled_Chebyshev_L2L                //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Computes L2L^T*charges for points x in the      //
+//                              interval center +/- radius, i.e., transfers the //
+//                              charges to the Chebyshev nodes, without forming //
+//                              L2L, a scaled copy of x or a table of Chebyshev //
+//                              polynomials.                                    //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      x                       -       Locations of points in the interval.    //
+//      n                       -       Number of points in the interval.       //
+//      center                  -       Center of the interval.                 //
+//      radius                  -       Radius of the interval.                 //
+//      x_Cheb_Nodes            -       Standard Cheb Nodes in interval [-1,1]. //
+//      rank                    -       Number of Chebyshev nodes.              //
+//      charges                 -       Matrix with 'n' rows and 'n_RHS'        //
+//                                      columns of charges at the points x.     //
+//      n_RHS                   -       Number of columns of charges.           //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      Node_Charges            -       Matrix with 'rank' rows and 'n_RHS'     //
+//                                      columns of charges at the nodes.        //
+//                                                                              //
+/********************************************************************************/
+void anterpolate_Scaled_Chebyshev_L2L(double* x, unsigned n, double center, double radius, double* x_Cheb_Nodes, unsigned rank, double* charges, unsigned n_RHS, double*& Node_Charges) {
+        //      Moments sum_i T_k(x_i)*charges(i,:) of the charges, in one sweep.
+        double* D       =       new double[rank*n_RHS];
+        for (unsigned j=0; j<rank*n_RHS; ++j) {
+                D[j]    =       0.0;
+        }
+        double* T       =       new double[rank];
+        unsigned index;
+        for (unsigned i=0; i<n; ++i) {
+                Chebyshev_polynomials_at_point(rank, (x[i]-center)/radius, T);
+
+                index   =       i*n_RHS;
+                for (unsigned k=0; k<rank; ++k) {
+                        for (unsigned l=0; l<n_RHS; ++l) {
+                                D[k*n_RHS+l]    =       D[k*n_RHS+l]+T[k]*charges[index+l];
+                        }
+                }
+        }
+
+        double* Tcheb;
+        get_weighted_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes(rank, x_Cheb_Nodes, Tcheb);
+
+        Node_Charges    =       new double[rank*n_RHS];
+        for (unsigned j=0; j<rank; ++j) {
+                for (unsigned l=0; l<n_RHS; ++l) {
+                        Node_Charges[j*n_RHS+l] =       0.0;
+                }
+                for (unsigned k=0; k<rank; ++k) {
+                        for (unsigned l=0; l<n_RHS; ++l) {
+                                Node_Charges[j*n_RHS+l] =       Node_Charges[j*n_RHS+l]+Tcheb[j*rank+k]*D[k*n_RHS+l];
+                        }
+                }
+        }
+
+        delete [] T;
+        delete [] D;
+        delete [] Tcheb;
+}
+
+
 /********************************************************************************/
 //      FUNCTION:               scale_Points                                    //
 //                                                                              //
@@ -43,6 +43,29 @@ void kernel1D(double* x1, unsigned n1, double* x2, unsigned n2, double*& K);
 /********************************************************************************/
 void Chebyshev_polynomials(unsigned rank, double* x, unsigned n, double*& T);
 
+/********************************************************************************/
+//      FUNCTION:               Chebyshev_polynomials_and_derivatives           //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Evaluates the first rank Chebyshev polynomials  //
+//                              and their derivatives at the locations x in     //
+//                              [-1,1]. The derivatives are obtained as         //
+//                              T'_k = k*U_{k-1}, where U_k are the Chebyshev   //
+//                              polynomials of the second kind.                 //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      rank    -       Number of terms in the approximation.                   //
+//      x       -       Location of points in the interval [-1,1].              //
+//      n       -       Number of points.                                       //
+//      T       -       Matrix with 'n' rows and 'rank' columns, where          //
+//                      T(rank*i+j) stores the 'j'th Chebyshev polynomial       //
+//                      evaluated at the 'i'th location.                        //
+//      dT      -       Matrix with 'n' rows and 'rank' columns, where          //
+//                      dT(rank*i+j) stores the derivative of the 'j'th         //
+//                      Chebyshev polynomial evaluated at the 'i'th location.   //
+//                                                                              //
+/********************************************************************************/
+void Chebyshev_polynomials_and_derivatives(unsigned rank, double* x, unsigned n, double*& T, double*& dT);
+
 /********************************************************************************/
 //      FUNCTION:               get_standard_Chebyshev_nodes                    //
 //                                                                              //
@@ -69,6 +92,55 @@ void get_standard_Chebyshev_nodes(unsigned rank, double*& standardchebnodes);
 /********************************************************************************************************/
 void get_standard_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes(unsigned rank, double*& T);
 
+/********************************************************************************************************/
+//      FUNCTION:               get_weighted_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes         //
+//                                                                                                      //
+//      PURPOSE OF EXISTENCE:   Evaluates the first rank Chebyshev polynomials at the Chebyshev nodes   //
+//                              with the weights of the interpolation formula folded in, so that the    //
+//                              L2L operator is L2L(i,j) = sum_k T_k(x_i)*T(rank*j+k).                  //
+//                                                                                                      //
+//      PARAMETERS:                                                                                     //
+//      rank                    -       The number of polynomials and the number of Chebyshev nodes.    //
+//      x_Cheb_Nodes            -       Standard Cheb Nodes in interval [-1,1].                         //
+//      T                       -       Matrix, where T(rank*j+k) stores (1 or 2)/rank times the 'k'th  //
+//                                      Chebyshev polynomial evaluated at the 'j'th node.               //
+//                                                                                                      //
+/********************************************************************************************************/
+void get_weighted_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes(unsigned rank, double* x_Cheb_Nodes, double*& T);
+
+/********************************************************************************/
+//      FUNCTION:               Chebyshev_polynomials_at_point                  //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Evaluates the first rank Chebyshev polynomials  //
+//                              at one location x in [-1,1] into a buffer.      //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      rank    -       Number of terms in the approximation.                   //
+//      x       -       Location of the point in the interval [-1,1].           //
+//      T       -       Buffer with 'rank' entries, where T[j] stores the 'j'th //
+//                      Chebyshev polynomial evaluated at x.                    //
+//                                                                              //
+/********************************************************************************/
+void Chebyshev_polynomials_at_point(unsigned rank, double x, double* T);
+
+/********************************************************************************/
+//      FUNCTION:               Chebyshev_polynomials_and_derivatives_at_point  //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Evaluates the first rank Chebyshev polynomials  //
+//                              and their derivatives T'_k = k*U_{k-1} at one   //
+//                              location x in [-1,1] into buffers.              //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      rank    -       Number of terms in the approximation.                   //
+//      x       -       Location of the point in the interval [-1,1].           //
+//      T       -       Buffer with 'rank' entries, where T[j] stores the 'j'th //
+//                      Chebyshev polynomial evaluated at x.                    //
+//      dT      -       Buffer with 'rank' entries, where dT[j] stores the      //
+//                      derivative of the 'j'th Chebyshev polynomial at x.      //
+//                                                                              //
+/********************************************************************************/
+void Chebyshev_polynomials_and_derivatives_at_point(unsigned rank, double x, double* T, double* dT);
+
 /********************************************************************************/
 //      FUNCTION:               get_Chebyshev_L2L_Operator                      //
 //                                                                              //
@@ -86,6 +158,131 @@ void get_standard_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes(unsigned ra
 /********************************************************************************/
 void get_Chebyshev_L2L_Operator(double* x, unsigned n, double* x_Cheb_Nodes, unsigned rank, double*& L2L);
 
+/********************************************************************************/
+//      FUNCTION:               get_Chebyshev_L2L_Operator_with_Derivative      //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Obtains the interpolation or L2L operator and   //
+//                              its derivative with respect to x, which         //
+//                              transfer information from the Chebyshev nodes   //
+//                              to the value and derivative at the points x.    //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      x                       -       Locations of points in interval [-1,1]. //
+//      n                       -       Number of points in the interval.       //
+//      x_Cheb_Nodes            -       Standard Cheb Nodes in interval [-1,1]. //
+//      rank                    -       Number of Chebyshev nodes.              //
+//      L2L                     -       Interpolation or L2L operator.          //
+//      dL2L                    -       Derivative of the L2L operator with     //
+//                                      respect to the standard location x.     //
+//                                      Divide by the radius of the cluster to  //
+//                                      obtain the derivative in the original   //
+//                                      coordinates.                            //
+//                                                                              //
+/********************************************************************************/
+void get_Chebyshev_L2L_Operator_with_Derivative(double* x, unsigned n, double* x_Cheb_Nodes, unsigned rank, double*& L2L, double*& dL2L);
+
+/********************************************************************************/
+//      FUNCTION:               apply_Chebyshev_L2L_with_Derivative             //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Interpolates the values 'q' at the Chebyshev    //
+//                              nodes to the points x and obtains the value and //
+//                              the derivative in one sweep over the points,    //
+//                              without forming the 'n' by 'rank' L2L operator. //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      x                       -       Locations of points in interval [-1,1]. //
+//      n                       -       Number of points in the interval.       //
+//      x_Cheb_Nodes            -       Standard Cheb Nodes in interval [-1,1]. //
+//      rank                    -       Number of Chebyshev nodes.              //
+//      radius                  -       Radius of the cluster, used to scale the//
+//                                      derivative to the original coordinates. //
+//      q                       -       Values at the 'rank' Chebyshev nodes.   //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      potential               -       Interpolated values at the points x.    //
+//      derivative              -       Interpolated derivative at the points x.//
+//                                                                              //
+/********************************************************************************/
+void apply_Chebyshev_L2L_with_Derivative(double* x, unsigned n, double* x_Cheb_Nodes, unsigned rank, double radius, double* q, double*& potential, double*& derivative);
+
+
+/********************************************************************************/
+//      FUNCTION:               get_Scaled_Chebyshev_L2L_Operator               //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Obtains the interpolation or L2L operator for   //
+//                              points x in the interval center +/- radius.     //
+//                              The points are scaled and the Chebyshev         //
+//                              polynomials evaluated one point at a time, so   //
+//                              no scaled copy of x and no 'n' by 'rank' table  //
+//                              of polynomials are formed.                      //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      x                       -       Locations of points in the interval.    //
+//      n                       -       Number of points in the interval.       //
+//      center                  -       Center of the interval.                 //
+//      radius                  -       Radius of the interval.                 //
+//      x_Cheb_Nodes            -       Standard Cheb Nodes in interval [-1,1]. //
+//      rank                    -       Number of Chebyshev nodes.              //
+//      L2L                     -       Interpolation or L2L operator.          //
+//                                                                              //
+/********************************************************************************/
+void get_Scaled_Chebyshev_L2L_Operator(double* x, unsigned n, double center, double radius, double* x_Cheb_Nodes, unsigned rank, double*& L2L);
+
+/********************************************************************************/
+//      FUNCTION:               apply_Scaled_Chebyshev_L2L                      //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Computes L2L*q for points x in the interval     //
+//                              center +/- radius without forming L2L, a scaled //
+//                              copy of x or a table of Chebyshev polynomials.  //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      x                       -       Locations of points in the interval.    //
+//      n                       -       Number of points in the interval.       //
+//      center                  -       Center of the interval.                 //
+//      radius                  -       Radius of the interval.                 //
+//      x_Cheb_Nodes            -       Standard Cheb Nodes in interval [-1,1]. //
+//      rank                    -       Number of Chebyshev nodes.              //
+//      q                       -       Matrix with 'rank' rows and 'n_RHS'     //
+//                                      columns of values at the nodes.         //
+//      n_RHS                   -       Number of columns of q.                 //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      potential               -       Matrix with 'n' rows and 'n_RHS'        //
+//                                      columns of values at the points x.      //
+//                                                                              //
+/********************************************************************************/
+void apply_Scaled_Chebyshev_L2L(double* x, unsigned n, double center, double radius, double* x_Cheb_Nodes, unsigned rank, double* q, unsigned n_RHS, double*& potential);
+
+/********************************************************************************/
+//      FUNCTION:               anterpolate_Scaled_Chebyshev_L2L                //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Computes L2L^T*charges for points x in the      //
+//                              interval center +/- radius, i.e., transfers the //
+//                              charges to the Chebyshev nodes, without forming //
+//                              L2L, a scaled copy of x or a table of Chebyshev //
+//                              polynomials.                                    //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      x                       -       Locations of points in the interval.    //
+//      n                       -       Number of points in the interval.       //
+//      center                  -       Center of the interval.                 //
+//      radius                  -       Radius of the interval.                 //
+//      x_Cheb_Nodes            -       Standard Cheb Nodes in interval [-1,1]. //
+//      rank                    -       Number of Chebyshev nodes.              //
+//      charges                 -       Matrix with 'n' rows and 'n_RHS'        //
+//                                      columns of charges at the points x.     //
+//      n_RHS                   -       Number of columns of charges.           //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      Node_Charges            -       Matrix with 'rank' rows and 'n_RHS'     //
+//                                      columns of charges at the nodes.        //
+//                                                                              //
+/********************************************************************************/
+void anterpolate_Scaled_Chebyshev_L2L(double* x, unsigned n, double center, double radius, double* x_Cheb_Nodes, unsigned rank, double* charges, unsigned n_RHS, double*& Node_Charges);
+
 
 /********************************************************************************/
 //      FUNCTION:               scale_Points                                    //
@@ -6,7 +6,11 @@
 //
 //
 
+#include <algorithm>
+#include <cfloat>
 #include <cmath>
+#include <map>
+#include <vector>
 #include "Chebyshev_Interpolation_1D.hpp"
 #include "Chebyshev_Interpolation_2D.hpp"
 
@@ -149,4 +153,612 @@ void get_Chebyshev_L2L_Operator(double* x, double* y, unsigned n, double* Cheb_N
                         L2L[index1+j]   =       L2Lx[index2+jx]*L2Ly[index2+jy];
                 }
         }
+}
+
+/********************************************************************************/
+//      FUNCTION:               get_Chebyshev_L2L_Operator_with_Gradient        //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Obtains the Chebyshev L2L Operator over the     //
+//                              square [-1,1]^2 along with its derivatives with //
+//                              respect to 'x' and 'y'.                         //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      x               -       'x' location of points in the square [-1,1]^2.  //
+//      y               -       'y' location of points in the square [-1,1]^2.  //
+//      n               -       Total number of points.                         //
+//      Cheb_Node       -       Location of Chebyshev nodes in [-1,1].          //
+//      rank            -       Number of Chebyshev nodes in [-1,1].            //
+//      L2L             -       Interpolation or L2L operator, which transfers  //
+//                              information from parent to child.               //
+//      L2L_x           -       Derivative of L2L with respect to 'x'.          //
+//      L2L_y           -       Derivative of L2L with respect to 'y'.          //
+//                              Both derivatives are with respect to the        //
+//                              standard location and need to be divided by the //
+//                              radius along that direction.                    //
+/********************************************************************************/
+void get_Chebyshev_L2L_Operator_with_Gradient(double* x, double* y, unsigned n, double* Cheb_Node, unsigned rank, double*& L2L, double*& L2L_x, double*& L2L_y) {
+
+        double* L2Lx;
+        double* dL2Lx;
+        get_Chebyshev_L2L_Operator_with_Derivative(x, n, Cheb_Node, rank, L2Lx, dL2Lx);
+
+        double* L2Ly;
+        double* dL2Ly;
+        get_Chebyshev_L2L_Operator_with_Derivative(y, n, Cheb_Node, rank, L2Ly, dL2Ly);
+
+        unsigned RANK   =       rank*rank;
+
+        unsigned jx, jy;
+
+        L2L     =       new double[n*RANK];
+        L2L_x   =       new double[n*RANK];
+        L2L_y   =       new double[n*RANK];
+        unsigned index1, index2;
+
+        for (unsigned i=0; i<n; ++i) {
+                index1  =       i*RANK;
+                index2  =       i*rank;
+                for (unsigned j=0; j<RANK; ++j) {
+                        jx              =       j%rank;
+                        jy              =       j/rank;
+
+                        L2L[index1+j]   =       L2Lx[index2+jx]*L2Ly[index2+jy];
+                        L2L_x[index1+j] =       dL2Lx[index2+jx]*L2Ly[index2+jy];
+                        L2L_y[index1+j] =       L2Lx[index2+jx]*dL2Ly[index2+jy];
+                }
+        }
+
+        delete [] L2Lx;
+        delete [] dL2Lx;
+        delete [] L2Ly;
+        delete [] dL2Ly;
+}
+
+/********************************************************************************/
+//      FUNCTION:               apply_Chebyshev_L2L_with_Gradient               //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Interpolates the values 'q' at the 'rank*rank'  //
+//                              Chebyshev nodes to the points (x,y) and obtains //
+//                              the value and the gradient in one sweep over    //
+//                              the points, without forming the L2L operator.   //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      x               -       'x' location of points in the square [-1,1]^2.  //
+//      y               -       'y' location of points in the square [-1,1]^2.  //
+//      n               -       Total number of points.                         //
+//      Cheb_Node       -       Location of Chebyshev nodes in [-1,1].          //
+//      rank            -       Number of Chebyshev nodes in [-1,1].            //
+//      x_Radius        -       Radius of the cluster along the X direction.    //
+//      y_Radius        -       Radius of the cluster along the Y direction.    //
+//      q               -       Values at the 'rank*rank' Chebyshev nodes,      //
+//                              ordered as in get_Scaled_Chebyshev_Nodes.       //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      potential       -       Interpolated values at the points.              //
+//      x_gradient      -       Interpolated derivative along 'x'.              //
+//      y_gradient      -       Interpolated derivative along 'y'.              //
+/********************************************************************************/
+void apply_Chebyshev_L2L_with_Gradient(double* x, double* y, unsigned n, double* Cheb_Node, unsigned rank, double x_Radius, double y_Radius, double* q, double*& potential, double*& x_gradient, double*& y_gradient) {
+
+        double* Tcheb;
+        get_weighted_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes(rank, Cheb_Node, Tcheb);
+
+        unsigned RANK   =       rank*rank;
+
+        //      Tensor-product Chebyshev coefficients of the interpolant, i.e., the
+        //      interpolant is sum_{kx,ky} C(rank*ky+kx)*T_kx(x)*T_ky(y).
+        double* A       =       new double[RANK];
+        double* C       =       new double[RANK];
+        for (unsigned jy=0; jy<rank; ++jy) {
+                for (unsigned kx=0; kx<rank; ++kx) {
+                        A[jy*rank+kx]   =       0.0;
+                        for (unsigned jx=0; jx<rank; ++jx) {
+                                A[jy*rank+kx]   =       A[jy*rank+kx]+q[jy*rank+jx]*Tcheb[jx*rank+kx];
+                        }
+                }
+        }
+        for (unsigned ky=0; ky<rank; ++ky) {
+                for (unsigned kx=0; kx<rank; ++kx) {
+                        C[ky*rank+kx]   =       0.0;
+                        for (unsigned jy=0; jy<rank; ++jy) {
+                                C[ky*rank+kx]   =       C[ky*rank+kx]+Tcheb[jy*rank+ky]*A[jy*rank+kx];
+                        }
+                }
+        }
+
+        potential       =       new double[n];
+        x_gradient      =       new double[n];
+        y_gradient      =       new double[n];
+
+        double* Tx      =       new double[rank];
+        double* dTx     =       new double[rank];
+        double* Ty      =       new double[rank];
+        double* dTy     =       new double[rank];
+        double sum_T, sum_dT;
+
+        for (unsigned i=0; i<n; ++i) {
+                Chebyshev_polynomials_and_derivatives_at_point(rank, x[i], Tx, dTx);
+                Chebyshev_polynomials_and_derivatives_at_point(rank, y[i], Ty, dTy);
+
+                potential[i]    =       0.0;
+                x_gradient[i]   =       0.0;
+                y_gradient[i]   =       0.0;
+                for (unsigned ky=0; ky<rank; ++ky) {
+                        sum_T   =       0.0;
+                        sum_dT  =       0.0;
+                        for (unsigned kx=0; kx<rank; ++kx) {
+                                sum_T   =       sum_T+C[ky*rank+kx]*Tx[kx];
+                                sum_dT  =       sum_dT+C[ky*rank+kx]*dTx[kx];
+                        }
+                        potential[i]    =       potential[i]+Ty[ky]*sum_T;
+                        x_gradient[i]   =       x_gradient[i]+Ty[ky]*sum_dT;
+                        y_gradient[i]   =       y_gradient[i]+dTy[ky]*sum_T;
+                }
+                x_gradient[i]   =       x_gradient[i]/x_Radius;
+                y_gradient[i]   =       y_gradient[i]/y_Radius;
+        }
+
+        delete [] Tx;
+        delete [] dTx;
+        delete [] Ty;
+        delete [] dTy;
+        delete [] A;
+        delete [] C;
+        delete [] Tcheb;
+}
+
+/********************************************************************************/
+//      FUNCTION:               get_Scaled_Chebyshev_L2L_Operator               //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Obtains the Chebyshev L2L Operator for points in//
+//                              the rectangle centered at (x_Center, y_Center)  //
+//                              with radii x_Radius and y_Radius. The points    //
+//                              are scaled to [-1,1]^2 one at a time, so no     //
+//                              scaled copies of x and y and no tables of       //
+//                              Chebyshev polynomials are formed.               //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      x               -       'x' location of points in the rectangle.        //
+//      y               -       'y' location of points in the rectangle.        //
+//      n               -       Total number of points.                         //
+//      x_Center        -       The 'x' coordinate of the center of cluster.    //
+//      x_Radius        -       Radius of the cluster along the X direction.    //
+//      y_Center        -       The 'y' coordinate of the center of cluster.    //
+//      y_Radius        -       Radius of the cluster along the Y direction.    //
+//      Cheb_Node       -       Location of Chebyshev nodes in [-1,1].          //
+//      rank            -       Number of Chebyshev nodes in [-1,1].            //
+//      L2L             -       Interpolation or L2L operator, which transfers  //
+//                              information from parent to child.               //
+/********************************************************************************/
+void get_Scaled_Chebyshev_L2L_Operator(double* x, double* y, unsigned n, double x_Center, double x_Radius, double y_Center, double y_Radius, double* Cheb_Node, unsigned rank, double*& L2L) {
+
+        double* Tcheb;
+        get_weighted_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes(rank, Cheb_Node, Tcheb);
+
+        unsigned RANK   =       rank*rank;
+        L2L             =       new double[n*RANK];
+        double* Tx      =       new double[rank];
+        double* Ty      =       new double[rank];
+        double* L2Lx    =       new double[rank];
+        double* L2Ly    =       new double[rank];
+        unsigned index;
+        for (unsigned i=0; i<n; ++i) {
+                Chebyshev_polynomials_at_point(rank, (x[i]-x_Center)/x_Radius, Tx);
+                Chebyshev_polynomials_at_point(rank, (y[i]-y_Center)/y_Radius, Ty);
+
+                for (unsigned j=0; j<rank; ++j) {
+                        L2Lx[j] =       0.0;
+                        L2Ly[j] =       0.0;
+                        for (unsigned k=0; k<rank; ++k) {
+                                L2Lx[j] =       L2Lx[j]+Tx[k]*Tcheb[j*rank+k];
+                                L2Ly[j] =       L2Ly[j]+Ty[k]*Tcheb[j*rank+k];
+                        }
+                }
+
+                index   =       i*RANK;
+                for (unsigned jy=0; jy<rank; ++jy) {
+                        for (unsigned jx=0; jx<rank; ++jx) {
+                                L2L[index+jy*rank+jx]   =       L2Lx[jx]*L2Ly[jy];
+                        }
+                }
+        }
+
+        delete [] Tx;
+        delete [] Ty;
+        delete [] L2Lx;
+        delete [] L2Ly;
+        delete [] Tcheb;
+}
+
+/********************************************************************************/
+//      FUNCTION:               apply_Scaled_Chebyshev_L2L                      //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Computes L2L*q for points in the rectangle      //
+//                              centered at (x_Center, y_Center) with radii     //
+//                              x_Radius and y_Radius, without forming L2L,     //
+//                              scaled copies of the points or tables of        //
+//                              Chebyshev polynomials.                          //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      x, y, n         -       Points as in get_Scaled_Chebyshev_L2L_Operator. //
+//      x_Center, ...   -       Box as in get_Scaled_Chebyshev_L2L_Operator.    //
+//      Cheb_Node       -       Location of Chebyshev nodes in [-1,1].          //
+//      rank            -       Number of Chebyshev nodes in [-1,1].            //
+//      q               -       Matrix with 'rank*rank' rows and 'n_RHS'        //
+//                              columns of values at the Chebyshev nodes.       //
+//      n_RHS           -       Number of columns of q.                         //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      potential       -       Matrix with 'n' rows and 'n_RHS' columns.       //
+/********************************************************************************/
+void apply_Scaled_Chebyshev_L2L(double* x, double* y, unsigned n, double x_Center, double x_Radius, double y_Center, double y_Radius, double* Cheb_Node, unsigned rank, double* q, unsigned n_RHS, double*& potential) {
+        potential       =       new double[n*n_RHS];
+        apply_Scaled_Chebyshev_L2L_to_Buffer(x, y, n, x_Center, x_Radius, y_Center, y_Radius, Cheb_Node, rank, q, n_RHS, potential);
+}
+
+/********************************************************************************/
+//      FUNCTION:               apply_Scaled_Chebyshev_L2L_to_Buffer            //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Same as apply_Scaled_Chebyshev_L2L, but writes  //
+//                              the result into a buffer provided by the caller,//
+//                              e.g., a block of a shared-memory segment.       //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      potential       -       Buffer with 'n*n_RHS' entries that receives the //
+//                              matrix with 'n' rows and 'n_RHS' columns. The   //
+//                              other parameters are as in                      //
+//                              apply_Scaled_Chebyshev_L2L.                     //
+/********************************************************************************/
+void apply_Scaled_Chebyshev_L2L_to_Buffer(double* x, double* y, unsigned n, double x_Center, double x_Radius, double y_Center, double y_Radius, double* Cheb_Node, unsigned rank, double* q, unsigned n_RHS, double* potential) {
+
+        double* Tcheb;
+        get_weighted_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes(rank, Cheb_Node, Tcheb);
+
+        //      Tensor-product Chebyshev coefficients of every column of q, i.e.,
+        //      C(ky,kx,:) = sum_{jy,jx} Tcheb(jy,ky)*Tcheb(jx,kx)*q(jy,jx,:).
+        unsigned RANK   =       rank*rank;
+        double* A       =       new double[RANK*n_RHS];
+        double* C       =       new double[RANK*n_RHS];
+        for (unsigned j=0; j<RANK*n_RHS; ++j) {
+                A[j]    =       0.0;
+                C[j]    =       0.0;
+        }
+        for (unsigned jy=0; jy<rank; ++jy) {
+                for (unsigned kx=0; kx<rank; ++kx) {
+                        for (unsigned jx=0; jx<rank; ++jx) {
+                                for (unsigned l=0; l<n_RHS; ++l) {
+                                        A[(jy*rank+kx)*n_RHS+l] =       A[(jy*rank+kx)*n_RHS+l]+Tcheb[jx*rank+kx]*q[(jy*rank+jx)*n_RHS+l];
+                                }
+                        }
+                }
+        }
+        for (unsigned ky=0; ky<rank; ++ky) {
+                for (unsigned jy=0; jy<rank; ++jy) {
+                        for (unsigned kx=0; kx<rank; ++kx) {
+                                for (unsigned l=0; l<n_RHS; ++l) {
+                                        C[(ky*rank+kx)*n_RHS+l] =       C[(ky*rank+kx)*n_RHS+l]+Tcheb[jy*rank+ky]*A[(jy*rank+kx)*n_RHS+l];
+                                }
+                        }
+                }
+        }
+
+        double* Tx      =       new double[rank];
+        double* Ty      =       new double[rank];
+        double* S       =       new double[n_RHS];
+        unsigned index;
+        for (unsigned i=0; i<n; ++i) {
+                Chebyshev_polynomials_at_point(rank, (x[i]-x_Center)/x_Radius, Tx);
+                Chebyshev_polynomials_at_point(rank, (y[i]-y_Center)/y_Radius, Ty);
+
+                index   =       i*n_RHS;
+                for (unsigned l=0; l<n_RHS; ++l) {
+                        potential[index+l]      =       0.0;
+                }
+                for (unsigned ky=0; ky<rank; ++ky) {
+                        for (unsigned l=0; l<n_RHS; ++l) {
+                                S[l]    =       0.0;
+                        }
+                        for (unsigned kx=0; kx<rank; ++kx) {
+                                for (unsigned l=0; l<n_RHS; ++l) {
+                                        S[l]    =       S[l]+Tx[kx]*C[(ky*rank+kx)*n_RHS+l];
+                                }
+                        }
+                        for (unsigned l=0; l<n_RHS; ++l) {
+                                potential[index+l]      =       potential[index+l]+Ty[ky]*S[l];
+                        }
+                }
+        }
+
+        delete [] Tx;
+        delete [] Ty;
+        delete [] S;
+        delete [] A;
+        delete [] C;
+        delete [] Tcheb;
+}
+
+/********************************************************************************/
+//      FUNCTION:               anterpolate_Scaled_Chebyshev_L2L                //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Computes L2L^T*charges for points in the        //
+//                              rectangle centered at (x_Center, y_Center) with //
+//                              radii x_Radius and y_Radius, i.e., transfers    //
+//                              the charges to the Chebyshev nodes, without     //
+//                              forming L2L, scaled copies of the points or     //
+//                              tables of Chebyshev polynomials.                //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      x, y, n         -       Points as in get_Scaled_Chebyshev_L2L_Operator. //
+//      x_Center, ...   -       Box as in get_Scaled_Chebyshev_L2L_Operator.    //
+//      Cheb_Node       -       Location of Chebyshev nodes in [-1,1].          //
+//      rank            -       Number of Chebyshev nodes in [-1,1].            //
+//      charges         -       Matrix with 'n' rows and 'n_RHS' columns.       //
+//      n_RHS           -       Number of columns of charges.                   //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      Node_Charges    -       Matrix with 'rank*rank' rows and 'n_RHS'        //
+//                              columns of charges at the Chebyshev nodes.      //
+/********************************************************************************/
+void anterpolate_Scaled_Chebyshev_L2L(double* x, double* y, unsigned n, double x_Center, double x_Radius, double y_Center, double y_Radius, double* Cheb_Node, unsigned rank, double* charges, unsigned n_RHS, double*& Node_Charges) {
+
+        //      Moments D(ky,kx,:) = sum_i T_ky(y_i)*T_kx(x_i)*charges(i,:), in one sweep.
+        unsigned RANK   =       rank*rank;
+        double* D       =       new double[RANK*n_RHS];
+        double* A       =       new double[RANK*n_RHS];
+        for (unsigned j=0; j<RANK*n_RHS; ++j) {
+                D[j]    =       0.0;
+                A[j]    =       0.0;
+        }
+        double* Tx      =       new double[rank];
+        double* Ty      =       new double[rank];
+        double* S       =       new double[rank*n_RHS];
+        unsigned index;
+        for (unsigned i=0; i<n; ++i) {
+                Chebyshev_polynomials_at_point(rank, (x[i]-x_Center)/x_Radius, Tx);
+                Chebyshev_polynomials_at_point(rank, (y[i]-y_Center)/y_Radius, Ty);
+
+                index   =       i*n_RHS;
+                for (unsigned kx=0; kx<rank; ++kx) {
+                        for (unsigned l=0; l<n_RHS; ++l) {
+                                S[kx*n_RHS+l]   =       Tx[kx]*charges[index+l];
+                        }
+                }
+                for (unsigned ky=0; ky<rank; ++ky) {
+                        for (unsigned j=0; j<rank*n_RHS; ++j) {
+                                D[ky*rank*n_RHS+j]      =       D[ky*rank*n_RHS+j]+Ty[ky]*S[j];
+                        }
+                }
+        }
+
+        double* Tcheb;
+        get_weighted_Chebyshev_polynomials_evaluated_at_Chebyshev_nodes(rank, Cheb_Node, Tcheb);
+
+        //      Node_Charges(jy,jx,:) = sum_{ky,kx} Tcheb(jy,ky)*Tcheb(jx,kx)*D(ky,kx,:).
+        for (unsigned jy=0; jy<rank; ++jy) {
+                for (unsigned ky=0; ky<rank; ++ky) {
+                        for (unsigned j=0; j<rank*n_RHS; ++j) {
+                                A[jy*rank*n_RHS+j]      =       A[jy*rank*n_RHS+j]+Tcheb[jy*rank+ky]*D[ky*rank*n_RHS+j];
+                        }
+                }
+        }
+        Node_Charges    =       new double[RANK*n_RHS];
+        for (unsigned j=0; j<RANK*n_RHS; ++j) {
+                Node_Charges[j] =       0.0;
+        }
+        for (unsigned jy=0; jy<rank; ++jy) {
+                for (unsigned jx=0; jx<rank; ++jx) {
+                        for (unsigned kx=0; kx<rank; ++kx) {
+                                for (unsigned l=0; l<n_RHS; ++l) {
+                                        Node_Charges[(jy*rank+jx)*n_RHS+l]      =       Node_Charges[(jy*rank+jx)*n_RHS+l]+Tcheb[jx*rank+kx]*A[(jy*rank+kx)*n_RHS+l];
+                                }
+                        }
+                }
+        }
+
+        delete [] Tx;
+        delete [] Ty;
+        delete [] S;
+        delete [] A;
+        delete [] D;
+        delete [] Tcheb;
+}
+
+/********************************************************************************/
+//      FUNCTION:               matrix_Multiply                                 //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Computes C = A*B for small row-major matrices.  //
+//                              The innermost loop runs along the rows of B and //
+//                              C so that several right hand sides are          //
+//                              processed together.                             //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      A               -       Matrix with 'm' rows and 'k' columns.           //
+//      B               -       Matrix with 'k' rows and 'n' columns.           //
+//      m, k, n         -       Dimensions of the product.                      //
+//      C               -       Matrix with 'm' rows and 'n' columns.           //
+/********************************************************************************/
+void matrix_Multiply(double* A, double* B, unsigned m, unsigned k, unsigned n, double*& C) {
+        C       =       new double[m*n];
+        for (unsigned j=0; j<m*n; ++j) {
+                C[j]    =       0.0;
+        }
+        double a;
+        unsigned index;
+        for (unsigned i=0; i<m; ++i) {
+                index   =       i*n;
+                for (unsigned l=0; l<k; ++l) {
+                        a       =       A[i*k+l];
+                        for (unsigned j=0; j<n; ++j) {
+                                C[index+j]      =       C[index+j]+a*B[l*n+j];
+                        }
+                }
+        }
+}
+
+/********************************************************************************/
+//      FUNCTION:               snap_To_Integer                                 //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Returns the nearest integer if 'value' is within//
+//                              'tolerance' of it and 'value' otherwise.        //
+/********************************************************************************/
+static double snap_To_Integer(double value, double tolerance) {
+        double nearest  =       floor(value+0.5);
+        return fabs(value-nearest) <= tolerance ? nearest : value;
+}
+
+/********************************************************************************/
+//      FUNCTION:               get_Cluster_Pair_Task_Key                       //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Obtains the key used to group the tasks in      //
+//                              evaluate_Cluster_Pair_Tasks: the rank, the      //
+//                              smallest radius of the two boxes, and the radii //
+//                              and the offset between the centers in units of  //
+//                              that radius. Ratios within a few ulps of an     //
+//                              integer, as in a tree, are snapped to it, so    //
+//                              that translated pairs get the same key despite  //
+//                              rounding in the center coordinates, while pairs //
+//                              whose geometry differs by more than rounding    //
+//                              get different keys.                             //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      task            -       The task.                                       //
+//      key             -       The key, with 8 entries.                        //
+/********************************************************************************/
+void get_Cluster_Pair_Task_Key(Cluster_Pair_Task& task, std::vector<double>& key) {
+        double unit     =       std::min(std::min(task.x_Radius_Source, task.y_Radius_Source), std::min(task.x_Radius_Target, task.y_Radius_Target));
+
+        //      Round the mantissa of the unit to 48 bits to absorb rounding in the radii.
+        int exponent;
+        double mantissa =       frexp(unit, &exponent);
+
+        //      A ratio is snapped only if it is within a few ulps of an integer: the
+        //      ulps of the ratio itself, plus those of the center coordinates for the
+        //      offsets, which lose their leading bits in the subtraction.
+        const double ulp        =       4.0*DBL_EPSILON;
+        double x_Ratio_Source   =       task.x_Radius_Source/unit;
+        double y_Ratio_Source   =       task.y_Radius_Source/unit;
+        double x_Ratio_Target   =       task.x_Radius_Target/unit;
+        double y_Ratio_Target   =       task.y_Radius_Target/unit;
+        double x_Offset         =       (task.x_Center_Source-task.x_Center_Target)/unit;
+        double y_Offset         =       (task.y_Center_Source-task.y_Center_Target)/unit;
+        double x_Magnitude      =       (fabs(task.x_Center_Source)+fabs(task.x_Center_Target))/unit;
+        double y_Magnitude      =       (fabs(task.y_Center_Source)+fabs(task.y_Center_Target))/unit;
+
+        key.resize(8);
+        key[0]  =       task.rank;
+        key[1]  =       ldexp(floor(ldexp(mantissa, 48)+0.5), exponent-48);
+        key[2]  =       snap_To_Integer(x_Ratio_Source, ulp*x_Ratio_Source);
+        key[3]  =       snap_To_Integer(y_Ratio_Source, ulp*y_Ratio_Source);
+        key[4]  =       snap_To_Integer(x_Ratio_Target, ulp*x_Ratio_Target);
+        key[5]  =       snap_To_Integer(y_Ratio_Target, ulp*y_Ratio_Target);
+        key[6]  =       snap_To_Integer(x_Offset, ulp*(fabs(x_Offset)+x_Magnitude));
+        key[7]  =       snap_To_Integer(y_Offset, ulp*(fabs(y_Offset)+y_Magnitude));
+}
+
+/********************************************************************************/
+//      FUNCTION:               evaluate_Cluster_Pair_Tasks                     //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Evaluates the low-rank interaction for a batch  //
+//                              of cluster pairs, each with a block of charge   //
+//                              vectors. Tasks with the same rank, the same box //
+//                              radii and the same offset between the source    //
+//                              and the target centers share the Chebyshev      //
+//                              nodes and the M2L operator, and the M2L is      //
+//                              applied once to the charges of all such tasks   //
+//                              stacked together. This relies on the kernel     //
+//                              being translation invariant, as kernel2D is.    //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      n_Tasks         -       Number of tasks.                                //
+//      tasks           -       The tasks. On exit 'potential' of every task    //
+//                              holds the approximate interaction times charges.//
+/********************************************************************************/
+void evaluate_Cluster_Pair_Tasks(unsigned n_Tasks, Cluster_Pair_Task* tasks) {
+
+        //      Group the tasks by rank and box geometry.
+        std::map<std::vector<double>, std::vector<unsigned> > groups;
+        for (unsigned t=0; t<n_Tasks; ++t) {
+                std::vector<double> key;
+                get_Cluster_Pair_Task_Key(tasks[t], key);
+                groups[key].push_back(t);
+        }
+
+        std::map<std::vector<double>, std::vector<unsigned> >::iterator it;
+        for (it=groups.begin(); it!=groups.end(); ++it) {
+                std::vector<unsigned>& members  =       it->second;
+                Cluster_Pair_Task& first        =       tasks[members[0]];
+                unsigned rank                   =       first.rank;
+                unsigned RANK                   =       rank*rank;
+
+                //      Chebyshev nodes and M2L shared by all the tasks in the group.
+                double* Cheb_Nodes;
+                get_standard_Chebyshev_nodes(rank, Cheb_Nodes);
+
+                double* x_Target_Cheb_Nodes;
+                double* y_Target_Cheb_Nodes;
+                get_Scaled_Chebyshev_Nodes(first.x_Center_Target, first.x_Radius_Target, first.y_Center_Target, first.y_Radius_Target, rank, Cheb_Nodes, x_Target_Cheb_Nodes, y_Target_Cheb_Nodes);
+
+                double* x_Source_Cheb_Nodes;
+                double* y_Source_Cheb_Nodes;
+                get_Scaled_Chebyshev_Nodes(first.x_Center_Source, first.x_Radius_Source, first.y_Center_Source, first.y_Radius_Source, rank, Cheb_Nodes, x_Source_Cheb_Nodes, y_Source_Cheb_Nodes);
+
+                double* M2L;
+                kernel2D(x_Target_Cheb_Nodes, y_Target_Cheb_Nodes, RANK, x_Source_Cheb_Nodes, y_Source_Cheb_Nodes, RANK, M2L);
+
+                //      Anterpolate the charges of every task and stack them as
+                //      columns of a 'RANK' by 'n_Columns' matrix.
+                std::vector<unsigned> offset(members.size()+1, 0);
+                for (unsigned m=0; m<members.size(); ++m) {
+                        offset[m+1]     =       offset[m]+tasks[members[m]].n_RHS;
+                }
+                unsigned n_Columns      =       offset[members.size()];
+
+                double* Stacked_Charges =       new double[RANK*n_Columns];
+                for (unsigned m=0; m<members.size(); ++m) {
+                        Cluster_Pair_Task& task =       tasks[members[m]];
+
+                        double* Node_Charges;
+                        anterpolate_Scaled_Chebyshev_L2L(task.x_Source, task.y_Source, task.n_Source, task.x_Center_Source, task.x_Radius_Source, task.y_Center_Source, task.y_Radius_Source, Cheb_Nodes, rank, task.charges, task.n_RHS, Node_Charges);
+
+                        for (unsigned i=0; i<RANK; ++i) {
+                                for (unsigned j=0; j<task.n_RHS; ++j) {
+                                        Stacked_Charges[i*n_Columns+offset[m]+j]        =       Node_Charges[i*task.n_RHS+j];
+                                }
+                        }
+
+                        delete [] Node_Charges;
+                }
+
+                //      One M2L product for all the tasks in the group.
+                double* Stacked_Local;
+                matrix_Multiply(M2L, Stacked_Charges, RANK, RANK, n_Columns, Stacked_Local);
+
+                //      Interpolate the local expansion of every task to its targets.
+                for (unsigned m=0; m<members.size(); ++m) {
+                        Cluster_Pair_Task& task =       tasks[members[m]];
+
+                        double* Local   =       new double[RANK*task.n_RHS];
+                        for (unsigned i=0; i<RANK; ++i) {
+                                for (unsigned j=0; j<task.n_RHS; ++j) {
+                                        Local[i*task.n_RHS+j]   =       Stacked_Local[i*n_Columns+offset[m]+j];
+                                }
+                        }
+
+                        apply_Scaled_Chebyshev_L2L(task.x_Target, task.y_Target, task.n_Target, task.x_Center_Target, task.x_Radius_Target, task.y_Center_Target, task.y_Radius_Target, Cheb_Nodes, rank, Local, task.n_RHS, task.potential);
+
+                        delete [] Local;
+                }
+
+                delete [] Cheb_Nodes;
+                delete [] x_Target_Cheb_Nodes;
+                delete [] y_Target_Cheb_Nodes;
+                delete [] x_Source_Cheb_Nodes;
+                delete [] y_Source_Cheb_Nodes;
+                delete [] M2L;
+                delete [] Stacked_Charges;
+                delete [] Stacked_Local;
+        }
 }
\ No newline at end of file
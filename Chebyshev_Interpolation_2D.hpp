@@ -9,6 +9,8 @@
 #ifndef __CHEBYSHEV_INTERPOLATION_2D__
 #define __CHEBYSHEV_INTERPOLATION_2D__
 
+#include <vector>
+
 /********************************************************************************/
 //      FUNCTION:               function2D                                      //
 //                                                                              //
@@ -93,4 +95,242 @@ void get_Scaled_Chebyshev_Nodes(double x_Center, double x_Radius, double y_Cente
 /********************************************************************************/
 void get_Chebyshev_L2L_Operator(double* x, double* y, unsigned n, double* Cheb_Node, unsigned rank, double*& L2L);
 
+/********************************************************************************/
+//      FUNCTION:               get_Chebyshev_L2L_Operator_with_Gradient        //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Obtains the Chebyshev L2L Operator over the     //
+//                              square [-1,1]^2 along with its derivatives with //
+//                              respect to 'x' and 'y'.                         //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      x               -       'x' location of points in the square [-1,1]^2.  //
+//      y               -       'y' location of points in the square [-1,1]^2.  //
+//      n               -       Total number of points.                         //
+//      Cheb_Node       -       Location of Chebyshev nodes in [-1,1].          //
+//      rank            -       Number of Chebyshev nodes in [-1,1].            //
+//      L2L             -       Interpolation or L2L operator, which transfers  //
+//                              information from parent to child.               //
+//      L2L_x           -       Derivative of L2L with respect to 'x'.          //
+//      L2L_y           -       Derivative of L2L with respect to 'y'.          //
+//                              Both derivatives are with respect to the        //
+//                              standard location and need to be divided by the //
+//                              radius along that direction.                    //
+/********************************************************************************/
+void get_Chebyshev_L2L_Operator_with_Gradient(double* x, double* y, unsigned n, double* Cheb_Node, unsigned rank, double*& L2L, double*& L2L_x, double*& L2L_y);
+
+/********************************************************************************/
+//      FUNCTION:               apply_Chebyshev_L2L_with_Gradient               //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Interpolates the values 'q' at the 'rank*rank'  //
+//                              Chebyshev nodes to the points (x,y) and obtains //
+//                              the value and the gradient in one sweep over    //
+//                              the points, without forming the L2L operator.   //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      x               -       'x' location of points in the square [-1,1]^2.  //
+//      y               -       'y' location of points in the square [-1,1]^2.  //
+//      n               -       Total number of points.                         //
+//      Cheb_Node       -       Location of Chebyshev nodes in [-1,1].          //
+//      rank            -       Number of Chebyshev nodes in [-1,1].            //
+//      x_Radius        -       Radius of the cluster along the X direction.    //
+//      y_Radius        -       Radius of the cluster along the Y direction.    //
+//      q               -       Values at the 'rank*rank' Chebyshev nodes,      //
+//                              ordered as in get_Scaled_Chebyshev_Nodes.       //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      potential       -       Interpolated values at the points.              //
+//      x_gradient      -       Interpolated derivative along 'x'.              //
+//      y_gradient      -       Interpolated derivative along 'y'.              //
+/********************************************************************************/
+void apply_Chebyshev_L2L_with_Gradient(double* x, double* y, unsigned n, double* Cheb_Node, unsigned rank, double x_Radius, double y_Radius, double* q, double*& potential, double*& x_gradient, double*& y_gradient);
+
+/********************************************************************************/
+//      FUNCTION:               get_Scaled_Chebyshev_L2L_Operator               //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Obtains the Chebyshev L2L Operator for points in//
+//                              the rectangle centered at (x_Center, y_Center)  //
+//                              with radii x_Radius and y_Radius. The points    //
+//                              are scaled to [-1,1]^2 one at a time, so no     //
+//                              scaled copies of x and y and no tables of       //
+//                              Chebyshev polynomials are formed.               //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      x               -       'x' location of points in the rectangle.        //
+//      y               -       'y' location of points in the rectangle.        //
+//      n               -       Total number of points.                         //
+//      x_Center        -       The 'x' coordinate of the center of cluster.    //
+//      x_Radius        -       Radius of the cluster along the X direction.    //
+//      y_Center        -       The 'y' coordinate of the center of cluster.    //
+//      y_Radius        -       Radius of the cluster along the Y direction.    //
+//      Cheb_Node       -       Location of Chebyshev nodes in [-1,1].          //
+//      rank            -       Number of Chebyshev nodes in [-1,1].            //
+//      L2L             -       Interpolation or L2L operator, which transfers  //
+//                              information from parent to child.               //
+/********************************************************************************/
+void get_Scaled_Chebyshev_L2L_Operator(double* x, double* y, unsigned n, double x_Center, double x_Radius, double y_Center, double y_Radius, double* Cheb_Node, unsigned rank, double*& L2L);
+
+/********************************************************************************/
+//      FUNCTION:               apply_Scaled_Chebyshev_L2L                      //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Computes L2L*q for points in the rectangle      //
+//                              centered at (x_Center, y_Center) with radii     //
+//                              x_Radius and y_Radius, without forming L2L,     //
+//                              scaled copies of the points or tables of        //
+//                              Chebyshev polynomials.                          //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      x, y, n         -       Points as in get_Scaled_Chebyshev_L2L_Operator. //
+//      x_Center, ...   -       Box as in get_Scaled_Chebyshev_L2L_Operator.    //
+//      Cheb_Node       -       Location of Chebyshev nodes in [-1,1].          //
+//      rank            -       Number of Chebyshev nodes in [-1,1].            //
+//      q               -       Matrix with 'rank*rank' rows and 'n_RHS'        //
+//                              columns of values at the Chebyshev nodes.       //
+//      n_RHS           -       Number of columns of q.                         //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      potential       -       Matrix with 'n' rows and 'n_RHS' columns.       //
+/********************************************************************************/
+void apply_Scaled_Chebyshev_L2L(double* x, double* y, unsigned n, double x_Center, double x_Radius, double y_Center, double y_Radius, double* Cheb_Node, unsigned rank, double* q, unsigned n_RHS, double*& potential);
+
+/********************************************************************************/
+//      FUNCTION:               apply_Scaled_Chebyshev_L2L_to_Buffer            //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Same as apply_Scaled_Chebyshev_L2L, but writes  //
+//                              the result into a buffer provided by the caller,//
+//                              e.g., a block of a shared-memory segment.       //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      potential       -       Buffer with 'n*n_RHS' entries that receives the //
+//                              matrix with 'n' rows and 'n_RHS' columns. The   //
+//                              other parameters are as in                      //
+//                              apply_Scaled_Chebyshev_L2L.                     //
+/********************************************************************************/
+void apply_Scaled_Chebyshev_L2L_to_Buffer(double* x, double* y, unsigned n, double x_Center, double x_Radius, double y_Center, double y_Radius, double* Cheb_Node, unsigned rank, double* q, unsigned n_RHS, double* potential);
+
+/********************************************************************************/
+//      FUNCTION:               anterpolate_Scaled_Chebyshev_L2L                //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Computes L2L^T*charges for points in the        //
+//                              rectangle centered at (x_Center, y_Center) with //
+//                              radii x_Radius and y_Radius, i.e., transfers    //
+//                              the charges to the Chebyshev nodes, without     //
+//                              forming L2L, scaled copies of the points or     //
+//                              tables of Chebyshev polynomials.                //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      x, y, n         -       Points as in get_Scaled_Chebyshev_L2L_Operator. //
+//      x_Center, ...   -       Box as in get_Scaled_Chebyshev_L2L_Operator.    //
+//      Cheb_Node       -       Location of Chebyshev nodes in [-1,1].          //
+//      rank            -       Number of Chebyshev nodes in [-1,1].            //
+//      charges         -       Matrix with 'n' rows and 'n_RHS' columns.       //
+//      n_RHS           -       Number of columns of charges.                   //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      Node_Charges    -       Matrix with 'rank*rank' rows and 'n_RHS'        //
+//                              columns of charges at the Chebyshev nodes.      //
+/********************************************************************************/
+void anterpolate_Scaled_Chebyshev_L2L(double* x, double* y, unsigned n, double x_Center, double x_Radius, double y_Center, double y_Radius, double* Cheb_Node, unsigned rank, double* charges, unsigned n_RHS, double*& Node_Charges);
+
+/********************************************************************************/
+//      FUNCTION:               matrix_Multiply                                 //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Computes C = A*B for small row-major matrices.  //
+//                              The innermost loop runs along the rows of B and //
+//                              C so that several right hand sides are          //
+//                              processed together.                             //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      A               -       Matrix with 'm' rows and 'k' columns.           //
+//      B               -       Matrix with 'k' rows and 'n' columns.           //
+//      m, k, n         -       Dimensions of the product.                      //
+//      C               -       Matrix with 'm' rows and 'n' columns.           //
+/********************************************************************************/
+void matrix_Multiply(double* A, double* B, unsigned m, unsigned k, unsigned n, double*& C);
+
+/********************************************************************************/
+//      STRUCTURE:              Cluster_Pair_Task                               //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Describes the interaction of one source cluster //
+//                              with one target cluster for a block of charge   //
+//                              vectors, to be evaluated in a batch.            //
+//                                                                              //
+//      MEMBERS:                                                                //
+//      x_Source        -       'x' location of the points in the source.       //
+//      y_Source        -       'y' location of the points in the source.       //
+//      n_Source        -       Number of points in the source cluster.         //
+//      x_Center_Source -       The 'x' coordinate of the center of the source. //
+//      x_Radius_Source -       Radius of the source along the X direction.     //
+//      y_Center_Source -       The 'y' coordinate of the center of the source. //
+//      y_Radius_Source -       Radius of the source along the Y direction.     //
+//      x_Target, ...   -       Same as above for the target cluster.           //
+//      rank            -       Number of Chebyshev nodes along one direction.  //
+//      n_RHS           -       Number of charge vectors.                       //
+//      charges         -       Matrix with 'n_Source' rows and 'n_RHS' columns,//
+//                              where charges(n_RHS*i+j) is the 'j'th charge of //
+//                              the 'i'th source point.                         //
+//      potential       -       Matrix with 'n_Target' rows and 'n_RHS' columns //
+//                              allocated and filled by the batched evaluation. //
+/********************************************************************************/
+struct Cluster_Pair_Task {
+        double* x_Source;
+        double* y_Source;
+        unsigned n_Source;
+        double x_Center_Source, x_Radius_Source;
+        double y_Center_Source, y_Radius_Source;
+
+        double* x_Target;
+        double* y_Target;
+        unsigned n_Target;
+        double x_Center_Target, x_Radius_Target;
+        double y_Center_Target, y_Radius_Target;
+
+        unsigned rank;
+        unsigned n_RHS;
+        double* charges;
+        double* potential;
+};
+
+/********************************************************************************/
+//      FUNCTION:               get_Cluster_Pair_Task_Key                       //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Obtains the key used to group the tasks in      //
+//                              evaluate_Cluster_Pair_Tasks: the rank, the      //
+//                              smallest radius of the two boxes, and the radii //
+//                              and the offset between the centers in units of  //
+//                              that radius. Ratios within a few ulps of an     //
+//                              integer, as in a tree, are snapped to it, so    //
+//                              that translated pairs get the same key despite  //
+//                              rounding in the center coordinates, while pairs //
+//                              whose geometry differs by more than rounding    //
+//                              get different keys.                             //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      task            -       The task.                                       //
+//      key             -       The key, with 8 entries.                        //
+/********************************************************************************/
+void get_Cluster_Pair_Task_Key(Cluster_Pair_Task& task, std::vector<double>& key);
+
+/********************************************************************************/
+//      FUNCTION:               evaluate_Cluster_Pair_Tasks                     //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Evaluates the low-rank interaction for a batch  //
+//                              of cluster pairs, each with a block of charge   //
+//                              vectors. Tasks with the same rank, the same box //
+//                              radii and the same offset between the source    //
+//                              and the target centers share the Chebyshev      //
+//                              nodes and the M2L operator, and the M2L is      //
+//                              applied once to the charges of all such tasks   //
+//                              stacked together. This relies on the kernel     //
+//                              being translation invariant, as kernel2D is.    //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      n_Tasks         -       Number of tasks.                                //
+//      tasks           -       The tasks. On exit 'potential' of every task    //
+//                              holds the approximate interaction times charges.//
+/********************************************************************************/
+void evaluate_Cluster_Pair_Tasks(unsigned n_Tasks, Cluster_Pair_Task* tasks);
+
 #endif /* defined(__CHEBYSHEV_INTERPOLATION_2D__) */
\ No newline at end of file
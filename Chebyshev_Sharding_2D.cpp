@@ -0,0 +1,250 @@
+//
+//  Chebyshev_Sharding_2D.cpp
+//  
+//
+//
+//
+
+#include <cstdio>
+#include <cstring>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "Chebyshev_Interpolation_1D.hpp"
+#include "Chebyshev_Interpolation_2D.hpp"
+#include "Chebyshev_Sharding_2D.hpp"
+
+/********************************************************************************/
+//      FUNCTION:               get_Number_Of_NUMA_Nodes                        //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Obtains the number of NUMA nodes on the machine //
+//                              from /sys/devices/system/node. Returns 1 if the //
+//                              information is not available.                   //
+//                                                                              //
+/********************************************************************************/
+unsigned get_Number_Of_NUMA_Nodes() {
+        unsigned n_Nodes        =       0;
+        char path[64];
+        while (true) {
+                snprintf(path, sizeof(path), "/sys/devices/system/node/node%u", n_Nodes);
+                if (access(path, F_OK) != 0) {
+                        break;
+                }
+                ++n_Nodes;
+        }
+        return n_Nodes > 0 ? n_Nodes : 1;
+}
+
+/********************************************************************************/
+//      FUNCTION:               bind_To_NUMA_Node                               //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Restricts the calling process to the CPUs of a  //
+//                              NUMA node, so that the memory it touches first  //
+//                              is placed on that node. Does nothing if the CPU //
+//                              list of the node cannot be read.                //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      node            -       Index of the NUMA node.                         //
+//                                                                              //
+/********************************************************************************/
+void bind_To_NUMA_Node(unsigned node) {
+        char path[64];
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node);
+        FILE* file      =       fopen(path, "r");
+        if (file == NULL) {
+                return;
+        }
+
+        //      The CPU list looks like "0-7,16-23".
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        unsigned first, last, n_CPUs = 0;
+        int n_Read;
+        while ((n_Read = fscanf(file, "%u-%u", &first, &last)) >= 1) {
+                if (n_Read == 1) {
+                        last    =       first;
+                }
+                for (unsigned cpu=first; cpu<=last && cpu<CPU_SETSIZE; ++cpu) {
+                        CPU_SET(cpu, &cpus);
+                        ++n_CPUs;
+                }
+                if (fgetc(file) != ',') {
+                        break;
+                }
+        }
+        fclose(file);
+
+        if (n_CPUs > 0) {
+                sched_setaffinity(0, sizeof(cpus), &cpus);
+        }
+}
+
+/********************************************************************************/
+//      FUNCTION:               evaluate_Shard                                  //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Interpolates the local expansion to the 'p'th   //
+//                              of 'n_Processes' contiguous blocks of targets   //
+//                              and records the time taken.                     //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      task            -       The cluster pair.                               //
+//      Cheb_Nodes      -       Chebyshev nodes in [-1,1].                      //
+//      Local           -       Local expansion at the nodes of the target,     //
+//                              with 'rank*rank' rows and 'n_RHS' columns.      //
+//      p               -       Index of the shard.                             //
+//      n_Processes     -       Number of shards.                               //
+//      potential       -       Potential at all the targets, of which the rows //
+//                              of the shard are written.                       //
+//      time            -       Time taken by every shard, of which the 'p'th   //
+//                              entry is written.                               //
+/********************************************************************************/
+static void evaluate_Shard(Cluster_Pair_Task& task, double* Cheb_Nodes, double* Local, unsigned p, unsigned n_Processes, double* potential, double* time) {
+        timeval start, end;
+        gettimeofday(&start, NULL);
+
+        unsigned begin  =       unsigned((unsigned long long)(task.n_Target)*p/n_Processes);
+        unsigned n      =       unsigned((unsigned long long)(task.n_Target)*(p+1)/n_Processes)-begin;
+
+        apply_Scaled_Chebyshev_L2L_to_Buffer(task.x_Target+begin, task.y_Target+begin, n, task.x_Center_Target, task.x_Radius_Target, task.y_Center_Target, task.y_Radius_Target, Cheb_Nodes, task.rank, Local, task.n_RHS, potential+size_t(begin)*task.n_RHS);
+
+        gettimeofday(&end, NULL);
+        time[p] =       (end.tv_sec-start.tv_sec)+1e-6*(end.tv_usec-start.tv_usec);
+}
+
+/********************************************************************************/
+//      FUNCTION:               evaluate_Sharded_Cluster_Pair                   //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Evaluates the low-rank interaction of one       //
+//                              cluster pair by splitting the targets across    //
+//                              several local worker processes, one per NUMA    //
+//                              node by default. The Chebyshev nodes and the    //
+//                              local expansion, i.e., M2L times the            //
+//                              anterpolated charges, are built once and placed //
+//                              in a shared-memory segment, which also receives //
+//                              the potential from every worker. The shard of a //
+//                              worker that does not exit cleanly is evaluated  //
+//                              again in the calling process. Linux only.       //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      task            -       The cluster pair and the block of charges, as   //
+//                              for evaluate_Cluster_Pair_Tasks.                //
+//      n_Processes     -       Number of worker processes. If 0, the number of //
+//                              NUMA nodes is used.                             //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      task.potential  -       Matrix with 'n_Target' rows and 'n_RHS' columns.//
+//      shard_Time      -       Wall clock time in seconds spent by every       //
+//                              worker, with 'n_Processes' entries.             //
+//                                                                              //
+/********************************************************************************/
+void evaluate_Sharded_Cluster_Pair(Cluster_Pair_Task& task, unsigned n_Processes, double*& shard_Time) {
+
+        unsigned n_NUMA_Nodes   =       get_Number_Of_NUMA_Nodes();
+        if (n_Processes == 0) {
+                n_Processes     =       n_NUMA_Nodes;
+        }
+
+        unsigned rank   =       task.rank;
+        unsigned RANK   =       rank*rank;
+        unsigned n_RHS  =       task.n_RHS;
+
+        //      Layout of the shared segment: Chebyshev nodes, local expansion at
+        //      the nodes of the target, potential at the targets and the time
+        //      taken by each shard.
+        size_t n_Doubles        =       size_t(rank)+size_t(RANK)*n_RHS+size_t(task.n_Target)*n_RHS+n_Processes;
+        double* shared          =       (double*) mmap(NULL, n_Doubles*sizeof(double), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+        //      Without a shared segment all the shards are evaluated in this process.
+        bool in_Process         =       (shared == MAP_FAILED);
+        if (in_Process) {
+                shared  =       new double[n_Doubles];
+        }
+        double* Cheb_Nodes      =       shared;
+        double* Local           =       Cheb_Nodes+rank;
+        double* potential       =       Local+RANK*n_RHS;
+        double* time            =       potential+size_t(task.n_Target)*n_RHS;
+
+        //      Chebyshev nodes.
+        double* Nodes;
+        get_standard_Chebyshev_nodes(rank, Nodes);
+        memcpy(Cheb_Nodes, Nodes, rank*sizeof(double));
+        delete [] Nodes;
+
+        //      M2L between the Chebyshev nodes of the target and the source.
+        double* x_Target_Cheb_Nodes;
+        double* y_Target_Cheb_Nodes;
+        get_Scaled_Chebyshev_Nodes(task.x_Center_Target, task.x_Radius_Target, task.y_Center_Target, task.y_Radius_Target, rank, Cheb_Nodes, x_Target_Cheb_Nodes, y_Target_Cheb_Nodes);
+
+        double* x_Source_Cheb_Nodes;
+        double* y_Source_Cheb_Nodes;
+        get_Scaled_Chebyshev_Nodes(task.x_Center_Source, task.x_Radius_Source, task.y_Center_Source, task.y_Radius_Source, rank, Cheb_Nodes, x_Source_Cheb_Nodes, y_Source_Cheb_Nodes);
+
+        double* M2L;
+        kernel2D(x_Target_Cheb_Nodes, y_Target_Cheb_Nodes, RANK, x_Source_Cheb_Nodes, y_Source_Cheb_Nodes, RANK, M2L);
+
+        //      Anterpolated charges at the Chebyshev nodes of the source and the
+        //      local expansion, built once for all the workers.
+        double* Node_Charges;
+        anterpolate_Scaled_Chebyshev_L2L(task.x_Source, task.y_Source, task.n_Source, task.x_Center_Source, task.x_Radius_Source, task.y_Center_Source, task.y_Radius_Source, Cheb_Nodes, rank, task.charges, n_RHS, Node_Charges);
+
+        double* Local_Expansion;
+        matrix_Multiply(M2L, Node_Charges, RANK, RANK, n_RHS, Local_Expansion);
+        memcpy(Local, Local_Expansion, RANK*n_RHS*sizeof(double));
+
+        delete [] x_Target_Cheb_Nodes;
+        delete [] y_Target_Cheb_Nodes;
+        delete [] x_Source_Cheb_Nodes;
+        delete [] y_Source_Cheb_Nodes;
+        delete [] M2L;
+        delete [] Node_Charges;
+        delete [] Local_Expansion;
+
+        //      Every worker evaluates a contiguous block of targets. If there is no
+        //      shared segment or fork fails, the shard is evaluated in this process.
+        pid_t* workers  =       new pid_t[n_Processes];
+        for (unsigned p=0; p<n_Processes; ++p) {
+                workers[p]      =       in_Process ? -1 : fork();
+                if (workers[p] == 0) {
+                        int status      =       0;
+                        try {
+                                bind_To_NUMA_Node(p%n_NUMA_Nodes);
+                                evaluate_Shard(task, Cheb_Nodes, Local, p, n_Processes, potential, time);
+                        }
+                        catch (...) {
+                                status  =       1;
+                        }
+                        _exit(status);
+                }
+                if (workers[p] < 0) {
+                        evaluate_Shard(task, Cheb_Nodes, Local, p, n_Processes, potential, time);
+                }
+        }
+
+        //      A worker that did not exit cleanly may have left its block of the
+        //      potential incomplete, so its shard is evaluated again in this process.
+        int status;
+        for (unsigned p=0; p<n_Processes; ++p) {
+                if (workers[p] > 0) {
+                        if (waitpid(workers[p], &status, 0) != workers[p] || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+                                evaluate_Shard(task, Cheb_Nodes, Local, p, n_Processes, potential, time);
+                        }
+                }
+        }
+        delete [] workers;
+
+        //      Gather the results out of the shared segment.
+        task.potential  =       new double[size_t(task.n_Target)*n_RHS];
+        memcpy(task.potential, potential, size_t(task.n_Target)*n_RHS*sizeof(double));
+        shard_Time      =       new double[n_Processes];
+        memcpy(shard_Time, time, n_Processes*sizeof(double));
+
+        if (in_Process) {
+                delete [] shared;
+        }
+        else {
+                munmap(shared, n_Doubles*sizeof(double));
+        }
+}
@@ -0,0 +1,66 @@
+//
+//  Chebyshev_Sharding_2D.hpp
+//  
+//
+//
+//
+
+#ifndef __CHEBYSHEV_SHARDING_2D__
+#define __CHEBYSHEV_SHARDING_2D__
+
+#include "Chebyshev_Interpolation_2D.hpp"
+
+/********************************************************************************/
+//      FUNCTION:               get_Number_Of_NUMA_Nodes                        //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Obtains the number of NUMA nodes on the machine //
+//                              from /sys/devices/system/node. Returns 1 if the //
+//                              information is not available.                   //
+//                                                                              //
+/********************************************************************************/
+unsigned get_Number_Of_NUMA_Nodes();
+
+/********************************************************************************/
+//      FUNCTION:               bind_To_NUMA_Node                               //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Restricts the calling process to the CPUs of a  //
+//                              NUMA node, so that the memory it touches first  //
+//                              is placed on that node. Does nothing if the CPU //
+//                              list of the node cannot be read.                //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      node            -       Index of the NUMA node.                         //
+//                                                                              //
+/********************************************************************************/
+void bind_To_NUMA_Node(unsigned node);
+
+/********************************************************************************/
+//      FUNCTION:               evaluate_Sharded_Cluster_Pair                   //
+//                                                                              //
+//      PURPOSE OF EXISTENCE:   Evaluates the low-rank interaction of one       //
+//                              cluster pair by splitting the targets across    //
+//                              several local worker processes, one per NUMA    //
+//                              node by default. The Chebyshev nodes and the    //
+//                              local expansion, i.e., M2L times the            //
+//                              anterpolated charges, are built once and placed //
+//                              in a shared-memory segment, which also receives //
+//                              the potential from every worker. The shard of a //
+//                              worker that does not exit cleanly is evaluated  //
+//                              again in the calling process. Linux only.       //
+//                                                                              //
+//      PARAMETERS:                                                             //
+//      INPUT:                                                                  //
+//      task            -       The cluster pair and the block of charges, as   //
+//                              for evaluate_Cluster_Pair_Tasks.                //
+//      n_Processes     -       Number of worker processes. If 0, the number of //
+//                              NUMA nodes is used.                             //
+//                                                                              //
+//      OUTPUT:                                                                 //
+//      task.potential  -       Matrix with 'n_Target' rows and 'n_RHS' columns.//
+//      shard_Time      -       Wall clock time in seconds spent by every       //
+//                              worker, with 'n_Processes' entries.             //
+//                                                                              //
+/********************************************************************************/
+void evaluate_Sharded_Cluster_Pair(Cluster_Pair_Task& task, unsigned n_Processes, double*& shard_Time);
+
+#endif /* defined(__CHEBYSHEV_SHARDING_2D__) */
@@ -85,4 +85,52 @@ int main() {
         cout << endl << "Number of points in the second cluster centered at " << center2 << " of length " << 2*radius2 << " is: " << n2 << endl;
         cout << endl << "Rank of interaction considered is: " << rank << endl;
         cout << endl << "Maximum error in the low-rank interaction between the two cluster is: " << (Kexact_E-L2L1_E*M2L_E*L2L2_E.transpose()).cwiseAbs().maxCoeff() << endl;
+
+        //      Obtain the potential and its derivative at the first cluster due to charges in the second cluster.
+        VectorXd charges        =       VectorXd::Random(n2);
+        VectorXd local          =       M2L_E*(L2L2_E.transpose()*charges);
+        double* potential;
+        double* derivative;
+        apply_Chebyshev_L2L_with_Derivative(x1_Standard_Location, n1, Cheb_Nodes, rank, radius1, local.data(), potential, derivative);
+
+        VectorXd potential_Exact        =       Kexact_E*charges;
+        VectorXd derivative_Exact(n1);
+        double R;
+        for (unsigned i=0; i<n1; ++i) {
+                derivative_Exact(i)     =       0.0;
+                for (unsigned j=0; j<n2; ++j) {
+                        R                       =       x1[i]-x2[j];
+                        derivative_Exact(i)     =       derivative_Exact(i)-2.0*charges(j)/(R*R*R);
+                }
+        }
+        Map<VectorXd> potential_E(potential, n1);
+        Map<VectorXd> derivative_E(derivative, n1);
+
+        cout << endl << "Maximum relative error in the potential is: " << (potential_Exact-potential_E).cwiseAbs().maxCoeff()/potential_Exact.cwiseAbs().maxCoeff() << endl;
+        cout << endl << "Maximum relative error in the derivative is: " << (derivative_Exact-derivative_E).cwiseAbs().maxCoeff()/derivative_Exact.cwiseAbs().maxCoeff() << endl;
+
+        //      The derivative of L2L is with respect to the standard location, so divide by the radius.
+        double* L2L1_Value;
+        double* dL2L1;
+        get_Chebyshev_L2L_Operator_with_Derivative(x1_Standard_Location, n1, Cheb_Nodes, rank, L2L1_Value, dL2L1);
+        Map<Matrix<double,Dynamic,Dynamic,RowMajor> >  L2L1_Value_E(L2L1_Value, n1, rank);
+        Map<Matrix<double,Dynamic,Dynamic,RowMajor> >  dL2L1_E(dL2L1, n1, rank);
+
+        cout << endl << "Maximum difference between the L2L and the apply potential is: " << (L2L1_Value_E*local-potential_E).cwiseAbs().maxCoeff() << endl;
+        cout << endl << "Maximum relative difference between the derivative of L2L and the apply derivative is: " << (dL2L1_E*local/radius1-derivative_E).cwiseAbs().maxCoeff()/derivative_E.cwiseAbs().maxCoeff() << endl;
+
+        //      Obtain the same operators directly from the unscaled points.
+        double* L2L1_Fused;
+        get_Scaled_Chebyshev_L2L_Operator(x1, n1, center1, radius1, Cheb_Nodes, rank, L2L1_Fused);
+        double* Node_Charges_Fused;
+        anterpolate_Scaled_Chebyshev_L2L(x2, n2, center2, radius2, Cheb_Nodes, rank, charges.data(), 1, Node_Charges_Fused);
+        double* potential_Fused;
+        apply_Scaled_Chebyshev_L2L(x1, n1, center1, radius1, Cheb_Nodes, rank, local.data(), 1, potential_Fused);
+        Map<Matrix<double,Dynamic,Dynamic,RowMajor> >  L2L1_Fused_E(L2L1_Fused, n1, rank);
+        Map<VectorXd> Node_Charges_Fused_E(Node_Charges_Fused, rank);
+        Map<VectorXd> potential_Fused_E(potential_Fused, n1);
+
+        cout << endl << "Maximum difference between the fused and the unfused L2L is: " << (L2L1_E-L2L1_Fused_E).cwiseAbs().maxCoeff() << endl;
+        cout << endl << "Maximum difference between the fused and the unfused anterpolation is: " << (L2L2_E.transpose()*charges-Node_Charges_Fused_E).cwiseAbs().maxCoeff() << endl;
+        cout << endl << "Maximum difference between the fused and the unfused interpolation is: " << (L2L1_E*local-potential_Fused_E).cwiseAbs().maxCoeff() << endl;
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <cstdlib>
 #include "Chebyshev_Interpolation_2D.hpp"
 #include "Chebyshev_Interpolation_1D.hpp"
+#include "Chebyshev_Sharding_2D.hpp"
 #include "Eigen/Dense"
 
 using namespace std;
@@ -111,4 +112,133 @@ int main() {
         cout << endl << "Number of points in the second cluster centered at (" << xcenter2 <<  ", " << ycenter2 << ") with side of length " << 2*xradius2 << " is: " << n2 << endl;
         cout << endl << "Rank of interaction considered is: " << RANK << endl;
         cout << endl << "Maximum error in the low-rank interaction between the two cluster is: " << (Kexact_E-L2L1_E*M2L_E*L2L2_E.transpose()).cwiseAbs().maxCoeff() << endl;
+
+        //      Obtain the potential and its gradient at the first cluster due to charges in the second cluster.
+        VectorXd charges        =       VectorXd::Random(n2);
+        VectorXd local          =       M2L_E*(L2L2_E.transpose()*charges);
+        double* potential;
+        double* x_gradient;
+        double* y_gradient;
+        apply_Chebyshev_L2L_with_Gradient(x1_Standard_Location, y1_Standard_Location, n1, Cheb_Nodes, rank, xradius1, yradius1, local.data(), potential, x_gradient, y_gradient);
+
+        VectorXd potential_Exact        =       Kexact_E*charges;
+        VectorXd x_gradient_Exact(n1);
+        VectorXd y_gradient_Exact(n1);
+        double Rsquare;
+        for (unsigned i=0; i<n1; ++i) {
+                x_gradient_Exact(i)     =       0.0;
+                y_gradient_Exact(i)     =       0.0;
+                for (unsigned j=0; j<n2; ++j) {
+                        Rsquare                 =       (x1[i]-x2[j])*(x1[i]-x2[j])+(y1[i]-y2[j])*(y1[i]-y2[j]);
+                        x_gradient_Exact(i)     =       x_gradient_Exact(i)+charges(j)*(x1[i]-x2[j])/Rsquare;
+                        y_gradient_Exact(i)     =       y_gradient_Exact(i)+charges(j)*(y1[i]-y2[j])/Rsquare;
+                }
+        }
+        Map<VectorXd> potential_E(potential, n1);
+        Map<VectorXd> x_gradient_E(x_gradient, n1);
+        Map<VectorXd> y_gradient_E(y_gradient, n1);
+
+        cout << endl << "Maximum relative error in the potential is: " << (potential_Exact-potential_E).cwiseAbs().maxCoeff()/potential_Exact.cwiseAbs().maxCoeff() << endl;
+        cout << endl << "Maximum relative error in the x-gradient is: " << (x_gradient_Exact-x_gradient_E).cwiseAbs().maxCoeff()/x_gradient_Exact.cwiseAbs().maxCoeff() << endl;
+        cout << endl << "Maximum relative error in the y-gradient is: " << (y_gradient_Exact-y_gradient_E).cwiseAbs().maxCoeff()/y_gradient_Exact.cwiseAbs().maxCoeff() << endl;
+
+        //      The derivatives of L2L are with respect to the standard location, so divide by the radii.
+        double* L2L1_Value;
+        double* L2L1_x;
+        double* L2L1_y;
+        get_Chebyshev_L2L_Operator_with_Gradient(x1_Standard_Location, y1_Standard_Location, n1, Cheb_Nodes, rank, L2L1_Value, L2L1_x, L2L1_y);
+        Map<Matrix<double,Dynamic,Dynamic,RowMajor> >  L2L1_Value_E(L2L1_Value, n1, RANK);
+        Map<Matrix<double,Dynamic,Dynamic,RowMajor> >  L2L1_x_E(L2L1_x, n1, RANK);
+        Map<Matrix<double,Dynamic,Dynamic,RowMajor> >  L2L1_y_E(L2L1_y, n1, RANK);
+
+        cout << endl << "Maximum difference between the L2L and the apply potential is: " << (L2L1_Value_E*local-potential_E).cwiseAbs().maxCoeff() << endl;
+        cout << endl << "Maximum relative difference between the x-derivative of L2L and the apply x-gradient is: " << (L2L1_x_E*local/xradius1-x_gradient_E).cwiseAbs().maxCoeff()/x_gradient_E.cwiseAbs().maxCoeff() << endl;
+        cout << endl << "Maximum relative difference between the y-derivative of L2L and the apply y-gradient is: " << (L2L1_y_E*local/yradius1-y_gradient_E).cwiseAbs().maxCoeff()/y_gradient_E.cwiseAbs().maxCoeff() << endl;
+
+        //      Evaluate several cluster pairs with several charge vectors in one batch:
+        //      0 and 1 are the pair above with different charges, 2 and 3 are the pair
+        //      translated by 1 and by 1.3 box widths along 'x', 4 has the source one
+        //      more box width away from the target and 5 has the source only 1e-7 box
+        //      widths away from where it is in 0, which must not share its group.
+        unsigned n_RHS          =       8;
+        unsigned n_Tasks        =       6;
+        double box_Width        =       2*xradius1;
+        double target_Shift[6]  =       {0, 0, box_Width, 1.3*box_Width, 0, 0};
+        double source_Shift[6]  =       {0, 0, box_Width, 1.3*box_Width, box_Width, 1e-7*box_Width};
+        MatrixXd Q1             =       MatrixXd::Random(n2, n_RHS);
+        Matrix<double,Dynamic,Dynamic,RowMajor> Q1_R  =       Q1;
+        Matrix<double,Dynamic,Dynamic,RowMajor> Q_R[6];
+
+        Cluster_Pair_Task tasks[6];
+        for (unsigned t=0; t<n_Tasks; ++t) {
+                scale_Points(0, 1, x2, n2, source_Shift[t], 1, tasks[t].x_Source);
+                tasks[t].y_Source               =       y2;
+                tasks[t].n_Source               =       n2;
+                tasks[t].x_Center_Source        =       xcenter2+source_Shift[t];
+                tasks[t].x_Radius_Source        =       xradius2;
+                tasks[t].y_Center_Source        =       ycenter2;
+                tasks[t].y_Radius_Source        =       yradius2;
+                scale_Points(0, 1, x1, n1, target_Shift[t], 1, tasks[t].x_Target);
+                tasks[t].y_Target               =       y1;
+                tasks[t].n_Target               =       n1;
+                tasks[t].x_Center_Target        =       xcenter1+target_Shift[t];
+                tasks[t].x_Radius_Target        =       xradius1;
+                tasks[t].y_Center_Target        =       ycenter1;
+                tasks[t].y_Radius_Target        =       yradius1;
+                tasks[t].rank                   =       rank;
+                tasks[t].n_RHS                  =       n_RHS;
+                Q_R[t]                          =       t==0 ? Q1_R : Matrix<double,Dynamic,Dynamic,RowMajor>(MatrixXd::Random(n2, n_RHS));
+                tasks[t].charges                =       Q_R[t].data();
+        }
+        evaluate_Cluster_Pair_Tasks(n_Tasks, tasks);
+
+        vector<double> key[6];
+        for (unsigned t=0; t<n_Tasks; ++t) {
+                get_Cluster_Pair_Task_Key(tasks[t], key[t]);
+        }
+        cout << endl << "Translated pairs share the same group: " << (key[0]==key[1] && key[0]==key[2] && key[0]==key[3] ? "yes" : "no") << endl;
+        cout << endl << "Pair with a different geometry is in a separate group: " << (key[0]!=key[4] ? "yes" : "no") << endl;
+        cout << endl << "Pair with a nearly identical geometry is in a separate group: " << (key[0]!=key[5] ? "yes" : "no") << endl;
+
+        double error_Batched    =       0.0;
+        MatrixXd P1_Exact       =       Kexact_E*Q1;
+        for (unsigned t=0; t<n_Tasks; ++t) {
+                double* K;
+                kernel2D(tasks[t].x_Target, y1, n1, tasks[t].x_Source, y2, n2, K);
+                Map<Matrix<double,Dynamic,Dynamic,RowMajor> >  K_E(K, n1, n2);
+                MatrixXd P_Exact        =       K_E*Q_R[t];
+                delete [] K;
+                Map<Matrix<double,Dynamic,Dynamic,RowMajor> >  P_E(tasks[t].potential, n1, n_RHS);
+                error_Batched           =       max(error_Batched, (P_Exact-P_E).cwiseAbs().maxCoeff()/P_Exact.cwiseAbs().maxCoeff());
+        }
+
+        cout << endl << "Maximum relative error in the batched evaluation is: " << error_Batched << endl;
+
+        //      Evaluate the same interaction with the targets split across worker processes.
+        unsigned n_Processes    =       2;
+        double* shard_Time;
+        delete [] tasks[0].potential;
+        evaluate_Sharded_Cluster_Pair(tasks[0], n_Processes, shard_Time);
+        Map<Matrix<double,Dynamic,Dynamic,RowMajor> >  P_Sharded_E(tasks[0].potential, n1, n_RHS);
+
+        cout << endl << "Maximum relative error in the sharded evaluation is: " << (P1_Exact-P_Sharded_E).cwiseAbs().maxCoeff()/P1_Exact.cwiseAbs().maxCoeff() << endl;
+        for (unsigned p=0; p<n_Processes; ++p) {
+                cout << endl << "Time taken by shard " << p << " is: " << shard_Time[p] << " seconds" << endl;
+        }
+
+        //      Obtain the same operators directly from the unscaled points.
+        double* L2L1_Fused;
+        get_Scaled_Chebyshev_L2L_Operator(x1, y1, n1, xcenter1, xradius1, ycenter1, yradius1, Cheb_Nodes, rank, L2L1_Fused);
+        double* Node_Charges_Fused;
+        anterpolate_Scaled_Chebyshev_L2L(x2, y2, n2, xcenter2, xradius2, ycenter2, yradius2, Cheb_Nodes, rank, Q1_R.data(), n_RHS, Node_Charges_Fused);
+        Matrix<double,Dynamic,Dynamic,RowMajor> Local_R       =       M2L_E*(L2L2_E.transpose()*Q1);
+        double* potential_Fused;
+        apply_Scaled_Chebyshev_L2L(x1, y1, n1, xcenter1, xradius1, ycenter1, yradius1, Cheb_Nodes, rank, Local_R.data(), n_RHS, potential_Fused);
+        Map<Matrix<double,Dynamic,Dynamic,RowMajor> >  L2L1_Fused_E(L2L1_Fused, n1, RANK);
+        Map<Matrix<double,Dynamic,Dynamic,RowMajor> >  Node_Charges_Fused_E(Node_Charges_Fused, RANK, n_RHS);
+        Map<Matrix<double,Dynamic,Dynamic,RowMajor> >  potential_Fused_E(potential_Fused, n1, n_RHS);
+
+        cout << endl << "Maximum difference between the fused and the unfused L2L is: " << (L2L1_E-L2L1_Fused_E).cwiseAbs().maxCoeff() << endl;
+        cout << endl << "Maximum difference between the fused and the unfused anterpolation is: " << (L2L2_E.transpose()*Q1-Node_Charges_Fused_E).cwiseAbs().maxCoeff() << endl;
+        cout << endl << "Maximum difference between the fused and the unfused interpolation is: " << (L2L1_E*Local_R-potential_Fused_E).cwiseAbs().maxCoeff() << endl;
 }
\ No newline at end of file